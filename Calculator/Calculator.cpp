@@ -6,6 +6,9 @@
 #include <iostream>  // Provides facilities for input/output operations (e.g., cin, cout)
 #include <iomanip>   // Allows formatting of output, such as setting decimal precision
 #include <algorithm> // Provides algorithms such as transform for modifying data (e.g., tolower for case-insensitive comparison)
+#include <cmath>     // Provides powf for powers whose result does not fit in 32 bits
+#include <climits>   // Provides LLONG_MAX and LLONG_MIN for overflow checks in the integer fast path
+#include <chrono>    // Provides steady_clock for timing the integer vs floating-point benchmark (CALCULATOR_BENCHMARK builds)
 #include <windows.h> // For GetConsoleScreenBufferInfo to enhance UI aesthetics
 
 using namespace std;
@@ -32,13 +35,15 @@ const int MAX_SIZE = 100; // Define the maximum size for storing parsed input
 class Expression
 {
 public:
-    float numbers[MAX_SIZE];  // Stores numbers in the expression
-    char operators[MAX_SIZE]; // Stores operators (+, -, *, /)
-    int numCount;             // Count of numbers in the expression
-    int opCount;              // Count of operators in the expression
-
-    // Constructor that intialises counts to zero
-    Expression() : numCount(0), opCount(0) {}
+    float numbers[MAX_SIZE];           // Stores numbers in the expression
+    long long intNumbers[MAX_SIZE];    // Stores exact 64-bit copies of the numbers (valid only while isInteger is true)
+    char operators[MAX_SIZE];          // Stores operators (+, -, *, /)
+    int numCount;                      // Count of numbers in the expression
+    int opCount;                       // Count of operators in the expression
+    bool isInteger;                    // True while every parsed number is an exact integer (no decimals, trig, ln or exp)
+
+    // Constructor that intialises counts to zero and assumes an integer-only expression until proven otherwise
+    Expression() : numCount(0), opCount(0), isInteger(true) {}
 };
 
 // Function to check if character is a digit
@@ -52,6 +57,86 @@ bool isOperator(char c)
     return (c == '+' || c == '-' || c == '*' || c == '/' || c == '^' || c == '!');
 }
 
+// Checked 64-bit integer arithmetic used by the integer fast path
+// Each function stores the exact result and returns true, or returns false (leaving result untouched) on overflow
+bool checkedAdd(long long a, long long b, long long& result)
+{
+    if ((b > 0 && a > LLONG_MAX - b) || (b < 0 && a < LLONG_MIN - b))
+    {
+        return false;
+    }
+    result = a + b;
+    return true;
+}
+
+bool checkedSubtract(long long a, long long b, long long& result)
+{
+    if ((b < 0 && a > LLONG_MAX + b) || (b > 0 && a < LLONG_MIN + b))
+    {
+        return false;
+    }
+    result = a - b;
+    return true;
+}
+
+bool checkedMultiply(long long a, long long b, long long& result)
+{
+    if (a > 0)
+    {
+        if ((b > 0 && a > LLONG_MAX / b) || (b < 0 && b < LLONG_MIN / a))
+        {
+            return false;
+        }
+    }
+    else if (a < 0)
+    {
+        if ((b > 0 && a < LLONG_MIN / b) || (b < 0 && a < LLONG_MAX / b))
+        {
+            return false;
+        }
+    }
+    result = a * b;
+    return true;
+}
+
+bool checkedPower(long long base, long long exponent, long long& result)
+{
+    if (exponent < 0) // Negative exponents produce fractions, leave them to the floating-point path
+    {
+        return false;
+    }
+
+    long long value = 1;
+    while (exponent > 0) // Exponentiation by squaring so that huge exponents of 0, 1 and -1 finish quickly
+    {
+        if ((exponent & 1) && !checkedMultiply(value, base, value))
+        {
+            return false;
+        }
+        exponent >>= 1;
+        if (exponent > 0 && !checkedMultiply(base, base, base))
+        {
+            return false;
+        }
+    }
+    result = value;
+    return true;
+}
+
+bool checkedFactorial(long long n, long long& result)
+{
+    long long value = 1;
+    for (long long i = 2; i <= n; i++) // 20! is the largest factorial that fits in 64 bits
+    {
+        if (!checkedMultiply(value, i, value))
+        {
+            return false;
+        }
+    }
+    result = value;
+    return true;
+}
+
 // Function to perform basic arithmetic and power operations
 float performOperation(float a, float b, char op)
 {
@@ -126,6 +211,13 @@ float performOperation(float a, float b, char op)
             int exp = static_cast<int>(b);
             int tempResult; // Temporary variable to store the result
 
+            // The asm power loop works in 32-bit registers, so only use it when the exact result fits in 32 bits
+            long long exactResult;
+            if (!checkedPower(base, exp, exactResult) || exactResult > INT_MAX || exactResult < INT_MIN)
+            {
+                return powf(static_cast<float>(base), static_cast<float>(exp)); // Negative exponent or large result
+            }
+
             _asm {
                 mov eax, dword ptr[base] // Load base into EAX
                 mov edx, dword ptr[exp] // Load exponent into EDX
@@ -291,6 +383,7 @@ float parseInput(const char* input, Expression& exp)
             // Compute trigonometric function result
             float trigResult = performTrigFunction(num, func);
             exp.numbers[exp.numCount++] = trigResult; // Store the computed trigonometric result in the numbers array and increment numCount
+            exp.isInteger = false;                    // Trigonometric results are not exact integers
             checkMinus = false;
             continue;
         }
@@ -299,14 +392,34 @@ float parseInput(const char* input, Expression& exp)
         {
             i = i + 1;
             float num = 0.0;
+            long long intNum = 0;  // Exact copy of the operand for the integer fast path
+            bool intValid = true;  // False once the operand or its factorial no longer fits in 64 bits
             while (isDigit(input[i]))
             {
                 num = num * 10.0f + (input[i] - '0'); // Build the number by multiplying by 10 and adding the new digit
+                if (!checkedMultiply(intNum, 10, intNum) || !checkedAdd(intNum, input[i] - '0', intNum))
+                {
+                    intValid = false; // Operand too large for 64 bits
+                }
                 i++;
             }
 
             // Compute factorial function result
-            float factResult = performFactorial(num);
+            // The asm factorial is exact up to 12! (32 bits), the 64-bit copy up to 20!, beyond that approximate with floats
+            float factResult = 1.0f;
+            if (intValid && checkedFactorial(intNum, exp.intNumbers[exp.numCount]))
+            {
+                factResult = intNum <= 12 ? static_cast<float>(performFactorial(num))
+                                          : static_cast<float>(exp.intNumbers[exp.numCount]);
+            }
+            else
+            {
+                exp.isInteger = false; // Factorial overflows 64 bits, fall back to the floating-point path
+                for (int k = 2; k <= num && !isinf(factResult); k++) // Stop once the product overflows to infinity
+                {
+                    factResult *= static_cast<float>(k);
+                }
+            }
             exp.numbers[exp.numCount++] = factResult; // Store the computed factorial result in the numbers array and increment numCount
             continue;
         }
@@ -350,6 +463,7 @@ float parseInput(const char* input, Expression& exp)
             // Compute natural logarithm function result
             float logResult = performLnFunction(num);
             exp.numbers[exp.numCount++] = logResult; // Store the computed natural logarithm result in the numbers array and increment numCount
+            exp.isInteger = false;                   // Logarithm results are not exact integers
             checkMinus = false;
             continue;
         }
@@ -393,6 +507,7 @@ float parseInput(const char* input, Expression& exp)
             // Compute exponential function result
             float expResult = performExpFunction(num);
             exp.numbers[exp.numCount++] = expResult; // Store the computed natural exponential result in the numbers array and increment numCount
+            exp.isInteger = false;                   // Exponential results are not exact integers
             checkMinus = false;
             continue;
         }
@@ -412,6 +527,7 @@ float parseInput(const char* input, Expression& exp)
             }
             bool decimalFound = false;
             float decimalPlace = 1.0f;
+            long long intNum = 0; // Exact copy of the number for the integer fast path
             while (isDigit(input[i]) || input[i] == '.')
             {
                 if (input[i] == '.')
@@ -433,9 +549,18 @@ float parseInput(const char* input, Expression& exp)
                 else
                 {
                     num = num * 10.0f + (input[i] - '0'); // Build the number by multiplying by 10 and adding the new digit
+                    if (!checkedMultiply(intNum, 10, intNum) || !checkedAdd(intNum, input[i] - '0', intNum))
+                    {
+                        exp.isInteger = false; // Number too large for 64 bits
+                    }
                 }
                 i++;
             }
+            if (decimalFound)
+            {
+                exp.isInteger = false; // Decimal numbers are handled by the floating-point path only
+            }
+            exp.intNumbers[exp.numCount] = intNum * sign;
             exp.numbers[exp.numCount++] = num * sign; // Num multiplied by -1 (sign) since it's negative then stored in numbers array
             checkMinus = false;
             continue;
@@ -446,6 +571,7 @@ float parseInput(const char* input, Expression& exp)
             float num = 0.0f;
             bool decimalFound = false;
             float decimalPlace = 1.0f;
+            long long intNum = 0; // Exact copy of the number for the integer fast path
 
             while (isDigit(input[i]) || input[i] == '.')
             {
@@ -469,9 +595,18 @@ float parseInput(const char* input, Expression& exp)
                 else
                 {
                     num = num * 10.0f + (input[i] - '0'); // Build the number by multiplying by 10 and adding the new digit
+                    if (!checkedMultiply(intNum, 10, intNum) || !checkedAdd(intNum, input[i] - '0', intNum))
+                    {
+                        exp.isInteger = false; // Number too large for 64 bits
+                    }
                 }
                 i++;
             }
+            if (decimalFound)
+            {
+                exp.isInteger = false; // Decimal numbers are handled by the floating-point path only
+            }
+            exp.intNumbers[exp.numCount] = intNum;
             exp.numbers[exp.numCount++] = num;
             checkMinus = false;
             continue;
@@ -490,6 +625,8 @@ float parseInput(const char* input, Expression& exp)
         cout << "\nError: Invalid input\n\n";
         return 3.402823466e+38f; // Return a sentinel value (maximum 32-bit floating) to indicate an error
     }
+
+    return 0.0f; // Parsing succeeded
 }
 
 // Function to evaluate expression following DMAS
@@ -575,6 +712,183 @@ float evaluateExpression(Expression& exp)
     return result;
 }
 
+// Function to evaluate an integer-only expression following DMAS using exact 64-bit arithmetic
+// Returns true and stores the exact value in result, or returns false when the expression must fall back to
+// evaluateExpression (overflow, inexact or zero division, negative exponent, or a malformed expression)
+bool evaluateIntegerExpression(const Expression& exp, long long& result)
+{
+    if (!exp.isInteger || exp.numCount != exp.opCount + 1)
+    {
+        return false;
+    }
+
+    // Work on copies so the floating-point data stays intact for the fallback path
+    long long numbers[MAX_SIZE];
+    char operators[MAX_SIZE];
+    int numCount = exp.numCount;
+    int opCount = exp.opCount;
+    for (int i = 0; i < numCount; i++)
+    {
+        numbers[i] = exp.intNumbers[i];
+    }
+    for (int i = 0; i < opCount; i++)
+    {
+        operators[i] = exp.operators[i];
+    }
+
+    // Handle powers (^) first, then multiplication and division, each left to right
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int i = 0; i < opCount; i++)
+        {
+            char op = operators[i];
+            if ((pass == 0 && op != '^') || (pass == 1 && op != '*' && op != '/'))
+            {
+                continue;
+            }
+
+            long long value;
+            if (op == '^')
+            {
+                if (!checkedPower(numbers[i], numbers[i + 1], value))
+                {
+                    return false;
+                }
+            }
+            else if (op == '*')
+            {
+                if (!checkedMultiply(numbers[i], numbers[i + 1], value))
+                {
+                    return false;
+                }
+            }
+            else // Division is only exact when the divisor divides the dividend evenly
+            {
+                long long divisor = numbers[i + 1];
+                if (divisor == 0 || (divisor == -1 && numbers[i] == LLONG_MIN) || numbers[i] % divisor != 0)
+                {
+                    return false;
+                }
+                value = numbers[i] / divisor;
+            }
+
+            // Replace the two numbers with the result and shift the remaining numbers and operators
+            numbers[i] = value;
+            for (int j = i + 1; j < numCount - 1; j++)
+            {
+                numbers[j] = numbers[j + 1];
+            }
+            for (int j = i; j < opCount - 1; j++)
+            {
+                operators[j] = operators[j + 1];
+            }
+            numCount--;
+            opCount--;
+
+            i--; // Adjust index to reprocess this position
+        }
+    }
+
+    // Then process addition and subtraction left to right
+    long long value = numbers[0];
+    for (int i = 0; i < opCount; i++)
+    {
+        if (operators[i] == '+')
+        {
+            if (!checkedAdd(value, numbers[i + 1], value))
+            {
+                return false;
+            }
+        }
+        else if (operators[i] == '-')
+        {
+            if (!checkedSubtract(value, numbers[i + 1], value))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false; // Unknown operator, let the floating-point path handle it
+        }
+    }
+
+    result = value;
+    return true;
+}
+
+#ifdef CALCULATOR_BENCHMARK
+// Function to benchmark the integer fast path against the floating-point path on integer-only workloads
+void runBenchmark()
+{
+    const char* workloads[] = {
+        "12*34-5^3+!10",
+        "2^20*3-7*11+!12",
+        "99999*99999+1",
+        "-17*23+9^4-!7*6",
+        "1+2+3+4+5+6+7+8+9+10",
+    };
+    const int ITERATIONS = 1000000;
+    volatile float floatSink = 0.0f;   // Prevents the compiler from discarding the timed work
+    volatile long long intSink = 0;
+
+    cout << "\nBenchmark: " << ITERATIONS << " runs per expression (evaluation only, parse timed separately)\n\n";
+    cout << fixed << setprecision(2);
+
+    for (const char* workload : workloads)
+    {
+        // Parsing is shared by both paths, so it is reported on its own line
+        auto parseStart = chrono::steady_clock::now();
+        for (int n = 0; n < ITERATIONS; n++)
+        {
+            Expression exp;
+            parseInput(workload, exp);
+        }
+        auto parseEnd = chrono::steady_clock::now();
+
+        Expression parsed;
+        parseInput(workload, parsed);
+
+        // Both loops copy the parsed Expression each run so the copy cost is identical
+        auto floatStart = chrono::steady_clock::now();
+        for (int n = 0; n < ITERATIONS; n++)
+        {
+            Expression copy = parsed;
+            floatSink = evaluateExpression(copy);
+        }
+        auto floatEnd = chrono::steady_clock::now();
+
+        bool exact = true;
+        auto intStart = chrono::steady_clock::now();
+        for (int n = 0; n < ITERATIONS; n++)
+        {
+            Expression copy = parsed;
+            long long value = 0;
+            exact = evaluateIntegerExpression(copy, value) && exact;
+            intSink = value;
+        }
+        auto intEnd = chrono::steady_clock::now();
+
+        double parseNs = chrono::duration<double, nano>(parseEnd - parseStart).count() / ITERATIONS;
+        double floatNs = chrono::duration<double, nano>(floatEnd - floatStart).count() / ITERATIONS;
+        double intNs = chrono::duration<double, nano>(intEnd - intStart).count() / ITERATIONS;
+
+        cout << "  " << workload << "\n";
+        cout << "    Parse:        " << parseNs << " ns/run\n";
+        cout << "    Float path:   " << floatNs << " ns/run, result " << floatSink << "\n";
+        if (exact)
+        {
+            cout << "    Integer path: " << intNs << " ns/run, result " << intSink << "\n";
+            cout << "    Speedup:      " << floatNs / intNs << "x\n\n";
+        }
+        else
+        {
+            cout << "    Integer path: not applicable (falls back to float)\n\n";
+        }
+    }
+}
+#endif
+
 // UI Improvement functions
 // Function to get the console width
 int getConsoleWidth()
@@ -599,6 +913,11 @@ void centerText(const string& text)
 
 int main()
 {
+#ifdef CALCULATOR_BENCHMARK
+    runBenchmark(); // Benchmark builds only run the timing loops, not the interactive calculator
+    return 0;
+#endif
+
     centerText("==============================================================");
     centerText("Scientific Calculator");
     centerText("==============================================================");
@@ -624,6 +943,7 @@ int main()
     centerText("  - Exponential Function: expx (e.g., exp2 for e^2)");
     centerText("  - Power: a^b (e.g., 2^3 for 2 raised to 3) (Integers only)");
     centerText("  - Square root: a^0.5");
+    centerText("  - Integer-only expressions are evaluated exactly in 64 bits");
     centerText("  - Type 'exit' to quit");
     centerText("==============================================================");
 
@@ -650,6 +970,15 @@ int main()
 
         float parseOutputCheck = parseInput(input, exp); // Parse the input into numbers and operators
 
+        // Integer-only expressions take the exact 64-bit path, anything else (or an overflow) falls through to the float path
+        long long intResult;
+        if (parseOutputCheck != 3.402823466e+38f && evaluateIntegerExpression(exp, intResult))
+        {
+            cout << "\nResult: " << intResult << "\n\n";
+            cout << "==============================================================\n";
+            continue;
+        }
+
         cout << fixed << setprecision(2);
         float result = evaluateExpression(exp); // Evaluate the expression
 